@@ -0,0 +1,37 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Action.h"
+
+/**
+ * Sets up the asymptotic expansion homogenization of the elastic constants in a nonlinear system
+ * of its own: one set of fluctuation displacements with their stress divergence and load case
+ * kernels, strain and stress materials, the AEHHomogenizedTensor collecting the constants and a
+ * postprocessor for each of the 21 independent constants. The load cases are solved by the
+ * AEHTransient executioner.
+ */
+class AEHElasticConstantsAction : public Action
+{
+public:
+  static InputParameters validParams();
+
+  AEHElasticConstantsAction(const InputParameters & params);
+
+  virtual void act();
+
+protected:
+  const NonlinearSystemName _aeh_system;
+  const std::string _var_name_base;
+  const UserObjectName _homogenized_tensor;
+
+  /// Fluctuation displacement variable names
+  std::vector<VariableName> _displacements;
+};
@@ -28,4 +28,5 @@ protected:
   const unsigned int _op_num;
   const std::string _var_name_base;
   const FileName _file_name;
+  const bool _share_grain_lookup;
 };
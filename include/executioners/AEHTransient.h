@@ -0,0 +1,45 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Transient.h"
+
+/**
+ * AEHTransient evolves the microstructure like Transient, solving only the first nonlinear
+ * system, and then computes the homogenized elastic constants once on the final microstructure.
+ * The six AEH load cases share one stiffness operator and only differ in their right hand side,
+ * so the operator and its preconditioner are assembled for the first load case and reused by the
+ * other five, each of which is a single linear solve. The AEH system is solved as a linear
+ * problem with its own prefixed PETSc options, independently of the solve_type and PETSc options
+ * of the executioner.
+ */
+class AEHTransient : public Transient
+{
+public:
+  static InputParameters validParams();
+
+  AEHTransient(const InputParameters & parameters);
+
+  virtual void init() override;
+  virtual void takeStep(Real input_dt = -1.0) override;
+
+protected:
+  /// Whether the step just taken is the last one of the transient
+  bool finalStep() const;
+
+  /// Solve the six load cases and compute the homogenized elastic constants
+  void solveElasticConstants();
+
+  /// Set the PETSc options of the AEH system, overriding any the executioner set for it
+  void setAEHPetscOptions();
+
+  const NonlinearSystemName _aeh_system;
+  const UserObjectName _homogenized_tensor;
+};
@@ -15,6 +15,7 @@
 // Forward Declarationsc
 class GrainTrackerInterface;
 class PolycrystalVoronoi;
+class PolycrystalVoronoiGrainCache;
 
 /**
  * PolycrystalVoronoiCoupledVoidIC initializes either grain or void values for a
@@ -40,6 +41,12 @@ protected:
 
   const PolycrystalVoronoi & _poly_ic_uo;
 
+  /// Grain lookups shared with the initial conditions of the other order parameters
+  const PolycrystalVoronoiGrainCache * const _grain_cache;
+
+  /// Whether polycrystal_ic_uo has sharp grain boundaries, i.e. a zero int_width
+  const bool _sharp_grain_boundaries;
+
   const FileName _file_name;
 
   virtual Real value(const Point & p) override;
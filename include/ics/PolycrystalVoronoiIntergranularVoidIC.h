@@ -10,8 +10,15 @@
 #pragma once
 
 #include "InitialCondition.h"
+#include "PerfGraphInterface.h"
+#include "KDTree.h"
 #include "MooseRandom.h"
 #include "PolycrystalICTools.h"
+#include "PeriodicCellList.h"
+#include "PoreProfileKernel.h"
+#include "VoronoiTopology.h"
+
+#include <functional>
 
 // Forward Declarationsc
 class GrainTrackerInterface;
@@ -21,7 +28,7 @@ class PolycrystalVoronoi;
  * PolycrystalVoronoiIntergranularVoidIC initializes either grain or void values for a
  * voronoi tesselation with voids distributed along the grain boundaries and triple junctions.
  */
-class PolycrystalVoronoiIntergranularVoidIC : public InitialCondition
+class PolycrystalVoronoiIntergranularVoidIC : public InitialCondition, public PerfGraphInterface
 {
 public:
   static InputParameters validParams();
@@ -34,17 +41,110 @@ public:
 
   virtual void initialSetup();
 
-protected:
+  /// Placed voids and their radii, available after initialSetup()
+  const std::vector<Point> & faceCenters() const { return _facecenters; }
+  const std::vector<Real> & faceRadii() const { return _faceradii; }
+  const std::vector<Point> & cornerCenters() const { return _cornercenters; }
+  const std::vector<Real> & cornerRadii() const { return _cornerradii; }
+
+  /// Whether voids are spheres rather than cylinders along z
+  bool spheres() const { return _3D_spheres; }
+
+  Real interfaceWidth() const { return _int_width; }
+
+  /// Distance between p and a void center as used by the profile (without z for cylinders)
+  Real voidCenterDistance(const Point & p, const Point & center) const;
+
+  /// Distance from p to the closest boundary of the Voronoi grain containing it
+  Real grainBoundaryDistance(const Point & p);
+
+  /// Directions in which minPeriodicDistance() wraps for this variable
+  std::array<bool, LIBMESH_DIM> periodicDirections();
+
+  enum class VoidType
+  {
+    CORNER,
+    FACE
+  };
+
+  /// Outcome of one attempt at placing a void center
+  enum class TrialResult
+  {
+    ACCEPTED,
+    OUT_OF_DOMAIN,
+    NOT_EQUIDISTANT,
+    SPACING,
+    DEGENERATE
+  };
+  static const unsigned int num_trial_results = 5;
+
+  /// Number of placement trials per TrialResult, summed over all voids of a type and all ranks
+  const std::vector<unsigned long> & trialCounts(VoidType type) const
+  {
+    return _trial_counts[static_cast<unsigned int>(type)];
+  }
 
-  virtual Real computeCircleValue(const Point & p, const Point & center, const Real & radius);
-  virtual RealGradient
-  computeCircleGradient(const Point & p, const Point & center, const Real & radius);
+  /// Volume of the placed voids over the domain volume, not accounting for overlaps
+  Real poreVolumeFraction() const;
 
+protected:
   virtual void computeFaceCircleRadii();
   virtual void computeFaceCircleCenters();
   virtual void computeCornerCircleRadii();
   virtual void computeCornerCircleCenters();
 
+  /// Source of uniform random numbers in [0, 1) for one candidate void center
+  typedef std::function<Real()> RandomDraw;
+
+  /// Draw one candidate void center on a triple junction or grain boundary
+  TrialResult sampleCornerCenter(Point & center, const RandomDraw & rand);
+  TrialResult sampleFaceCenter(Point & center, const RandomDraw & rand);
+
+  /// Draw one candidate void center and check it against the voids placed so far
+  TrialResult cornerTrial(Point & center, const RandomDraw & rand);
+  TrialResult faceTrial(Point & center, const RandomDraw & rand);
+
+  /// Count a placement trial in _trial_counts
+  void recordTrial(VoidType type, TrialResult result)
+  {
+    ++_trial_counts[static_cast<unsigned int>(type)][static_cast<unsigned int>(result)];
+  }
+
+  /// First valid trial for void vp, evaluated in batches across ranks and threads
+  Point parallelTrials(VoidType type, unsigned int vp);
+
+  /// Take over the voids placed by the copy of this initial condition on another thread
+  void copyPlacement(const PolycrystalVoronoiIntergranularVoidIC & other);
+
+  /// Project a random point onto the closest triple junction, false for degenerate grain centers
+  bool projectToTripleJunction(const Point & rand_point, Point & center);
+
+  /// Project a random point onto the closest grain boundary
+  Point projectToGrainBoundary(const Point & rand_point);
+
+  /// Whether the three nearest grain centers are equidistant
+  bool isTripleJunction(const Point & center);
+
+  /// Whether the two nearest grain centers are equidistant, but not the three nearest
+  bool isGrainBoundary(const Point & center);
+
+  bool inDomain(const Point & center) const;
+
+  /// Map a point outside the domain back in along the periodic grain center directions
+  void wrapIntoDomain(Point & center) const;
+
+  /// Hash of the inputs that determine the void layout, apart from the number of voids
+  uint64_t layoutHash();
+
+  /// Load previously placed voids from _layout_file
+  void readLayout();
+
+  /// Store the placed voids in _layout_file
+  void writeLayout();
+
+  /// Bin the placed pores by the region their interface profile can reach
+  void buildPoreIndex();
+
   MooseMesh & _mesh;
 
   Real _invalue;
@@ -62,6 +162,13 @@ protected:
   std::vector<Point> _cornercenters;
   std::vector<Real> _cornerradii;
 
+  /// Spatial index over the pores, faces are stored with their index and corners offset by the
+  /// number of faces so that each cell lists pores in the same order as the full pore loops
+  PeriodicCellList _pore_cells;
+
+  /// Pore centers and radii in the same order, for evaluating the profile of many pores at once
+  PoreProfileKernel _pore_kernel;
+
   enum class ProfileType
   {
     COS,
@@ -77,6 +184,35 @@ protected:
 
   const unsigned int _max_num_tries;
 
+  /// Use counter based random streams and evaluate the trials in parallel
+  const bool _parallel_placement;
+
+  enum class PlacementMethod
+  {
+    REJECTION,
+    TOPOLOGY
+  } _placement_method;
+
+  enum class LayoutMode
+  {
+    NONE,
+    READ,
+    WRITE,
+    GROW
+  } _layout_mode;
+
+  const FileName _layout_file;
+
+  /// Placement trials per outcome for corner and face voids
+  std::array<std::vector<unsigned long>, 2> _trial_counts;
+
+  /// Number of voids loaded from the layout file that are kept by the placement
+  unsigned int _num_loaded_corner;
+  unsigned int _num_loaded_face;
+
+  /// Grain boundaries and triple junctions for the topology placement method
+  VoronoiTopology _topology;
+
   const Real _faceradius;
   const Real _faceradius_variation;
   const MooseEnum _faceradius_variation_type;
@@ -114,4 +250,19 @@ protected:
   {
     bool operator()(const DistancePoint & a, const DistancePoint & b) { return a.d < b.d; }
   } _customLess;
+
+  /// The k grain centers (including periodic images) closest to p, sorted by distance
+  std::vector<DistancePoint> nearestGrains(const Point & p, unsigned int k);
+
+  /// Three smallest grain center distances as tracked by the original scan over all grain
+  /// centers, reproduced up to \p reach beyond the nearest one
+  std::array<Real, 3> scannedGrainDistances(const Point & center, Real reach);
+
+  /// Nearest neighbor search tree over _pbc_centerpoints
+  std::unique_ptr<KDTree> _grain_kd_tree;
+
+  /// Spacing checks between already placed corner and face pores
+  PeriodicCellList _corner_spacing_cells;
+  PeriodicCellList _face_spacing_cells;
+  PeriodicCellList _face_corner_spacing_cells;
 };
@@ -0,0 +1,38 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Kernel.h"
+#include "RankFourTensor.h"
+
+class AEHHomogenizedTensor;
+
+/**
+ * AEHLoadCaseKernel is the right hand side of the asymptotic expansion homogenization cell
+ * problem, like AsymptoticExpansionHomogenizationKernel, but for the load case currently selected
+ * in an AEHHomogenizedTensor. One set of fluctuation displacements then serves all six load cases,
+ * which only differ in this right hand side.
+ */
+class AEHLoadCaseKernel : public Kernel
+{
+public:
+  static InputParameters validParams();
+
+  AEHLoadCaseKernel(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+
+  const std::string _base_name;
+  const MaterialProperty<RankFourTensor> & _elasticity_tensor;
+  const unsigned int _component;
+
+  const AEHHomogenizedTensor & _homogenized_tensor;
+};
@@ -0,0 +1,57 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Marker.h"
+#include "PeriodicCellList.h"
+
+class PolycrystalVoronoiIntergranularVoidIC;
+
+/**
+ * PolycrystalVoronoiVoidMarker marks the elements within a band around the void surfaces placed
+ * by a PolycrystalVoronoiIntergranularVoidIC and around the Voronoi grain boundaries. The
+ * geometry is known analytically, so the marker can be used for the initial adaptivity steps to
+ * resolve the diffuse interfaces on an otherwise coarse mesh.
+ */
+class PolycrystalVoronoiVoidMarker : public Marker
+{
+public:
+  static InputParameters validParams();
+
+  PolycrystalVoronoiVoidMarker(const InputParameters & parameters);
+
+protected:
+  virtual void markerSetup() override;
+  virtual MarkerValue computeElementMarker() override;
+
+  /// Largest distance between the vertex average of an element and its nodes
+  Real elementRadius(const Elem & elem) const;
+
+  /// Whether a void surface passes within reach of p
+  bool nearVoidSurface(const Point & p, Real reach) const;
+
+  const MarkerValue _inside;
+  const MarkerValue _outside;
+
+  const std::string _void_ic_name;
+  const bool _refine_grain_boundaries;
+
+  /// Void initial condition on this thread, found in markerSetup()
+  std::shared_ptr<PolycrystalVoronoiIntergranularVoidIC> _void_ic;
+
+  Real _void_band;
+  Real _grain_boundary_band;
+
+  /// Largest element radius on this processor when the voids were binned
+  Real _max_elem_radius;
+
+  /// Voids binned by their radius plus the band and the largest element radius
+  PeriodicCellList _void_cells;
+};
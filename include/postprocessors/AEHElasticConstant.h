@@ -0,0 +1,35 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+class AEHHomogenizedTensor;
+
+/**
+ * AEHElasticConstant reports one homogenized elastic constant collected by an
+ * AEHHomogenizedTensor
+ */
+class AEHElasticConstant : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  AEHElasticConstant(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual PostprocessorValue getValue() const override;
+
+protected:
+  const AEHHomogenizedTensor & _homogenized_tensor;
+  const unsigned int _row;
+  const unsigned int _column;
+};
@@ -0,0 +1,66 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+#include "GeneralReporter.h"
+
+class PolycrystalVoronoiIntergranularVoidIC;
+
+/**
+ * PolycrystalVoronoiVoidPlacementReporter reports how the voids of a
+ * PolycrystalVoronoiIntergranularVoidIC were placed: the number of placement trials, the number
+ * of trials rejected for each reason and the pore volume fraction that was achieved. Slow
+ * placements can be diagnosed from the CSV output or the summary printed to the console.
+ */
+class PolycrystalVoronoiVoidPlacementReporter : public GeneralReporter
+{
+public:
+  static InputParameters validParams();
+
+  PolycrystalVoronoiVoidPlacementReporter(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  /// Trial counts of one void type
+  struct TrialValues
+  {
+    Real & trials;
+    Real & out_of_domain;
+    Real & not_equidistant;
+    Real & spacing;
+    Real & degenerate;
+  };
+
+  /// Declare the trial counts prefixed by the void type
+  TrialValues declareTrialValues(const std::string & prefix);
+
+  /// Fill the trial counts from the initial condition
+  void reportTrials(const std::vector<unsigned long> & counts, TrialValues & values) const;
+
+  /// Print the trial counts of one void type
+  void printTrials(const std::string & type,
+                   std::size_t num_voids,
+                   const std::vector<unsigned long> & counts) const;
+
+  const std::string _void_ic_name;
+
+  /// Void initial condition of the first thread, which placed the voids
+  std::shared_ptr<PolycrystalVoronoiIntergranularVoidIC> _void_ic;
+
+  TrialValues _corner;
+  TrialValues _face;
+
+  Real & _pore_volume_fraction;
+};
@@ -0,0 +1,71 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ElementUserObject.h"
+#include "RankFourTensor.h"
+
+/**
+ * AEHHomogenizedTensor holds the current load case of an asymptotic expansion homogenization
+ * (AEH) solve with a single set of fluctuation displacements, and collects the homogenized
+ * elastic constants one column at a time. After the fluctuation chi^kl of load case kl has been
+ * solved for, executing this object computes the column
+ *
+ *   C^H_ijkl = 1/|Y| int_Y (C_ijkl + C_ijmn d chi^kl_m / d y_n) dY
+ *
+ * for all six Voigt rows ij (xx yy zz yz xz xy).
+ */
+class AEHHomogenizedTensor : public ElementUserObject
+{
+public:
+  static InputParameters validParams();
+
+  AEHHomogenizedTensor(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+  /// Select the Voigt column (0-5) the fluctuation displacements are solved for
+  void setLoadCase(unsigned int load_case);
+
+  /// Deselect the load case once all six have been solved for
+  void clearLoadCase() { _load_case = no_load_case; }
+
+  /// Selected Voigt column, no_load_case outside of the load case solves
+  unsigned int loadCase() const { return _load_case; }
+
+  static const unsigned int no_load_case = 6;
+
+  /// Tensor indices of a Voigt index, in the order xx yy zz yz xz xy
+  static unsigned int voigtIndex(unsigned int voigt, unsigned int i) { return _voigt[voigt][i]; }
+
+  /// Homogenized elastic constant in Voigt notation, valid once its column has been computed
+  Real elasticConstant(unsigned int row, unsigned int column) const;
+
+protected:
+  static const unsigned int _voigt[6][2];
+
+  const std::string _base_name;
+  const MaterialProperty<RankFourTensor> & _elasticity_tensor;
+
+  const unsigned int _ndisp;
+  std::vector<const VariableGradient *> _grad_disp;
+
+  unsigned int _load_case;
+
+  /// Integrals of the current column and the volume
+  std::array<Real, 6> _integral;
+  Real _volume;
+
+  /// Homogenized constants in Voigt notation
+  std::array<std::array<Real, 6>, 6> _tensor;
+};
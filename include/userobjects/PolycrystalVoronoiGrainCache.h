@@ -0,0 +1,51 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ThreadedGeneralUserObject.h"
+
+// Forward Declarations
+class PolycrystalVoronoi;
+
+/**
+ * PolycrystalVoronoiGrainCache remembers the grains found by a PolycrystalVoronoi user object at
+ * the points of the current element, i.e. the grain containing the point and, for diffuse grain
+ * boundaries, the neighboring grains within int_width. The initial conditions of all order
+ * parameters visit the same element one after the other, so only the first of them has to search
+ * for the grains.
+ */
+class PolycrystalVoronoiGrainCache : public ThreadedGeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  PolycrystalVoronoiGrainCache(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+  virtual void threadJoin(const UserObject &) override {}
+
+  /// Grains at point p of element elem, the grain containing p first
+  const std::vector<unsigned int> & getGrainsBasedOnPoint(const Elem * elem, const Point & p) const;
+
+protected:
+  const UserObjectName _poly_ic_uo_name;
+
+  /// Grain structure, found in initialSetup()
+  const PolycrystalVoronoi * _poly_ic_uo;
+
+  /// Element the cached points belong to
+  mutable const Elem * _cached_elem;
+
+  /// Points of _cached_elem and their grains
+  mutable std::vector<std::pair<Point, std::vector<unsigned int>>> _cache;
+};
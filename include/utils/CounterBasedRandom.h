@@ -0,0 +1,45 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <cstdint>
+
+/**
+ * Counter based random numbers: every number is a pure function of a key and a counter, so
+ * independent streams can be evaluated in any order, on any thread or rank, with identical
+ * results. Based on the splitmix64 finalizer.
+ */
+namespace CounterBasedRandom
+{
+inline uint64_t
+mix(uint64_t x)
+{
+  x += 0x9e3779b97f4a7c15ull;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+  return x ^ (x >> 31);
+}
+
+/// Key of the stream identified by three integers
+inline uint64_t
+key(uint64_t a, uint64_t b, uint64_t c)
+{
+  return mix(mix(mix(a) ^ b) ^ c);
+}
+
+/// Uniform random number in [0, 1)
+inline Real
+uniform(uint64_t key, uint64_t counter)
+{
+  return (mix(key ^ mix(counter)) >> 11) * 0x1.0p-53;
+}
+}
@@ -0,0 +1,68 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "libmesh/point.h"
+
+#include <array>
+#include <vector>
+
+/**
+ * PeriodicCellList bins objects with a finite reach (e.g. a pore radius plus its interface
+ * half-width) into a uniform grid of cells spanning an axis-aligned box. Every object is stored
+ * in each cell its reach overlaps, wrapping around periodic directions, so that a point query
+ * only has to visit the objects listed in the single cell containing the point. Within a cell
+ * objects are kept in insertion order.
+ */
+class PeriodicCellList
+{
+public:
+  PeriodicCellList();
+
+  /**
+   * Set up an empty grid over the box [bottom_left, top_right]. Only the first \p dim directions
+   * are binned, the remaining ones are ignored by insert() and candidates(). Cells are at least
+   * \p min_cell_size wide and at most \p max_cells cells are created.
+   */
+  void init(const Point & bottom_left,
+            const Point & top_right,
+            unsigned int dim,
+            const std::array<bool, LIBMESH_DIM> & periodic,
+            Real min_cell_size,
+            std::size_t max_cells = 1 << 20);
+
+  /// Remove all objects while keeping the grid
+  void clear();
+
+  /// Add object \p id centered at \p center to every cell within \p reach of it
+  void insert(unsigned int id, const Point & center, Real reach);
+
+  /// Objects whose reach may contain \p p, in insertion order
+  const std::vector<unsigned int> & candidates(const Point & p) const;
+
+  /// Number of cells in the grid
+  std::size_t numCells() const { return _cells.size(); }
+
+protected:
+  /// Cell coordinate (unclamped) of x along direction d
+  long int cellCoordinate(unsigned int d, Real x) const;
+
+  unsigned int _dim;
+  Point _bottom_left;
+  std::array<bool, LIBMESH_DIM> _periodic;
+  std::array<unsigned int, LIBMESH_DIM> _num_cells;
+  std::array<Real, LIBMESH_DIM> _cell_width;
+
+  /// Padding added to every reach to absorb round-off in the cell coordinates
+  Real _pad;
+
+  std::vector<std::vector<unsigned int>> _cells;
+};
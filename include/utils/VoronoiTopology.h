@@ -0,0 +1,91 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "libmesh/point.h"
+
+#include <vector>
+
+/**
+ * VoronoiTopology computes the grain boundaries and triple junctions of the Voronoi tessellation
+ * of a set of grain centers by clipping the cell of every grain with the bisector planes of its
+ * neighbors. In 3D the grain boundaries are stored as triangles and the triple junctions as line
+ * segments, in 2D (or for columnar grains, using the x-y coordinates only) the grain boundaries
+ * are segments and the triple junctions are points. Points on them can then be drawn uniformly
+ * with respect to their area, length or count.
+ */
+class VoronoiTopology
+{
+public:
+  VoronoiTopology();
+
+  /**
+   * Build the topology of the cells of the first \p num_grains entries of \p seeds. The remaining
+   * seeds (e.g. periodic images) only act as neighbors. For a non-periodic tessellation the cells
+   * are clipped by the box [bottom_left, top_right] and the box faces are not grain boundaries.
+   */
+  void build(const std::vector<Point> & seeds,
+             unsigned int num_grains,
+             const Point & bottom_left,
+             const Point & top_right,
+             bool two_dimensional,
+             bool periodic);
+
+  /// Total grain boundary area (3D) or length (2D)
+  Real grainBoundaryMeasure() const { return _gb_cdf.empty() ? 0.0 : _gb_cdf.back(); }
+
+  /// Total triple junction length (3D) or number of triple junctions (2D)
+  Real tripleJunctionMeasure() const { return _tj_cdf.empty() ? 0.0 : _tj_cdf.back(); }
+
+  /// Draw a point on the grain boundaries from three uniform random numbers in [0, 1)
+  Point sampleGrainBoundary(Real r0, Real r1, Real r2) const;
+
+  /// Draw a point on the triple junctions from two uniform random numbers in [0, 1)
+  Point sampleTripleJunction(Real r0, Real r1) const;
+
+protected:
+  /// Planar convex polygon with the index of the seed on its other side (-1 for the box)
+  struct Face
+  {
+    int neighbor;
+    std::vector<Point> vertices;
+  };
+
+  /// Cut \p cell down to the half space closer to \p seed than to \p other
+  void clip(std::vector<Face> & cell, const Point & seed, const Point & other, int neighbor) const;
+
+  /// 2D version of clip() acting on a polygon with one neighbor per edge
+  void clip2D(std::vector<Point> & vertices,
+              std::vector<int> & edge_neighbors,
+              const Point & seed,
+              const Point & other,
+              int neighbor) const;
+
+  /// Collect the grain boundaries and triple junctions of a finished cell
+  void addCell(const std::vector<Face> & cell);
+  void addCell2D(const std::vector<Point> & vertices, const std::vector<int> & edge_neighbors);
+
+  /// Index of the entry of a cumulative distribution containing r * total
+  static std::size_t pick(const std::vector<Real> & cdf, Real r);
+
+  bool _two_dimensional;
+
+  /// Geometric tolerance, relative to the box size
+  Real _tol;
+
+  /// Grain boundary triangles (3D) or segments (2D) as consecutive points
+  std::vector<Point> _gb_points;
+  std::vector<Real> _gb_cdf;
+
+  /// Triple junction segments (3D) as consecutive points, or triple junction points (2D)
+  std::vector<Point> _tj_points;
+  std::vector<Real> _tj_cdf;
+};
@@ -0,0 +1,90 @@
+# Times the placement and evaluation of the intergranular void initial condition and of the
+# coupled grain initial conditions on a Voronoi polycrystal with grains of unit area or volume.
+# The PerfGraph output lists the placement phases, the placement reporter the trials and
+# rejections. run_placement_benchmark.sh sweeps the grain count, the void density, the
+# dimension, the periodicity and the placement method over the command line; the defaults are
+# the 104 grain, non-periodic 2D case.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 102
+  ny = 102
+  xmax = 10.2
+  ymax = 10.2
+[]
+
+[GlobalParams]
+  op_num = 10
+  grain_num = 104
+  var_name_base = gr
+  int_width = 0.1
+
+  numfacebub = 104
+  faceradius = 0.08
+  facebubspac = 0.24
+
+  numcornerbub = 26
+  cornerradius = 0.12
+  cornerbubspac = 0.36
+
+  invalue = 1
+  outvalue = 0
+  numtries = 1e6
+[]
+
+[Variables]
+  [./PolycrystalVariables]
+  [../]
+[]
+
+[AuxVariables]
+  [./void]
+  [../]
+[]
+
+[ICs]
+  [./PolycrystalICs]
+    [./PolycrystalVoronoiCoupledVoidIC]
+      v = void
+      polycrystal_ic_uo = voronoi_ic_uo
+    [../]
+  [../]
+  [./void]
+    type = PolycrystalVoronoiIntergranularVoidIC
+    variable = void
+    polycrystal_ic_uo = voronoi_ic_uo
+  [../]
+[]
+
+[UserObjects]
+  [./voronoi_ic_uo]
+    type = PolycrystalVoronoi
+    coloring_algorithm = jp
+    rand_seed = 12345
+  [../]
+[]
+
+[Reporters]
+  [./placement]
+    type = PolycrystalVoronoiVoidPlacementReporter
+    void_ic = void
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Outputs]
+  csv = true
+  [./perf_graph]
+    type = PerfGraphOutput
+    level = 3
+    heaviest_sections = 10
+  [../]
+[]
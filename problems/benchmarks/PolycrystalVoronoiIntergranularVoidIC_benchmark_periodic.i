@@ -0,0 +1,10 @@
+# The placement benchmark with periodic boundaries, run_placement_benchmark.sh adds z in 3D.
+!include PolycrystalVoronoiIntergranularVoidIC_benchmark.i
+
+[BCs]
+  [./Periodic]
+    [./all]
+      auto_direction = 'x y'
+    [../]
+  [../]
+[]
@@ -0,0 +1,73 @@
+#!/usr/bin/env bash
+# Runs PolycrystalVoronoiIntergranularVoidIC_benchmark.i for 104 to 7000 grains of unit size,
+# two void densities, 2D, 3D and columnar grains, with and without periodic boundaries and with
+# the rejection and topology placement methods. Each case writes <case>.log with the PerfGraph
+# table and the placement summary, and <case>.csv with the placement reporter values. The
+# placement summary and the void initial condition sections of the PerfGraph are echoed.
+#
+# Usage: run_placement_benchmark.sh <app executable> [launcher, e.g. mpiexec -n 4]
+
+set -e
+
+if [ $# -lt 1 ]; then
+  echo "Usage: $0 <app executable> [launcher ...]"
+  exit 1
+fi
+
+app=$1
+shift
+launcher=("$@")
+
+cd "$(dirname "$0")"
+mkdir -p results
+
+for mode in 2D 3D columnar; do
+  for grains in 104 708 2300 7000; do
+    # Grains of unit area in 2D and in the x-y plane of columnar grains, of unit volume in 3D.
+    # The interface width sets the element size, coarser in 3D to keep the meshes tractable.
+    if [ $mode = 3D ]; then
+      side=$(awk -v n=$grains 'BEGIN { printf "%.4f", n ^ (1 / 3) }')
+      op_num=64
+    else
+      side=$(awk -v n=$grains 'BEGIN { printf "%.4f", sqrt(n) }')
+      op_num=21
+    fi
+    width=$([ $mode = 2D ] && echo 0.1 || echo 0.25)
+    cells=$(awk -v s=$side -v w=$width 'BEGIN { printf "%d", s / w + 0.999 }')
+
+    args=(GlobalParams/grain_num=$grains GlobalParams/op_num=$op_num GlobalParams/int_width=$width
+          Mesh/nx=$cells Mesh/ny=$cells Mesh/xmax=$side Mesh/ymax=$side)
+    if [ $mode = 3D ]; then
+      args+=(Mesh/dim=3 Mesh/nz=$cells Mesh/zmax=$side
+             GlobalParams/faceradius=0.15 GlobalParams/facebubspac=0.45
+             GlobalParams/cornerradius=0.2 GlobalParams/cornerbubspac=0.6)
+    elif [ $mode = columnar ]; then
+      args+=(Mesh/dim=3 Mesh/nz=16 Mesh/zmax=4
+             ICs/void/columnar_grains=true ICs/void/3D_spheres=false
+             UserObjects/voronoi_ic_uo/columnar_3D=true)
+    fi
+
+    for density in 1 3; do
+      density_args=(GlobalParams/numfacebub=$((density * grains))
+                    GlobalParams/numcornerbub=$((density * grains / 4)))
+
+      for periodic in false true; do
+        input=PolycrystalVoronoiIntergranularVoidIC_benchmark.i
+        periodic_args=()
+        if [ $periodic = true ]; then
+          input=PolycrystalVoronoiIntergranularVoidIC_benchmark_periodic.i
+          [ $mode != 2D ] && periodic_args=("BCs/Periodic/all/auto_direction=x y z")
+        fi
+
+        for method in rejection topology; do
+          case=results/${mode}_${grains}grains_density${density}_periodic_${periodic}_${method}
+          echo "== $case"
+          "${launcher[@]}" "$app" -i $input "${args[@]}" "${density_args[@]}" \
+            "${periodic_args[@]}" ICs/void/placement_method=$method \
+            Outputs/file_base=$case > $case.log 2>&1 || { tail -n 20 $case.log; exit 1; }
+          grep -E "voids:|Pore volume fraction|VoidIC" $case.log || true
+        done
+      done
+    done
+  done
+done
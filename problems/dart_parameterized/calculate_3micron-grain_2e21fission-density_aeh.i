@@ -0,0 +1,615 @@
+[Problem]
+  nl_sys_names = 'nl0 aeh'
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 177
+  ny = 177
+  nz = 177
+  xmax = 5317
+  ymax = 5317
+  zmax = 5317
+  elem_type = HEX8
+[]
+
+[GlobalParams]
+  op_num = 10
+  var_name_base = etam
+  int_width = 60
+
+  use_kdtree = true
+
+  numfacebub = 1000
+  faceradius = 90
+  facebubspac = 270
+
+  numcornerbub = 1
+  cornerradius = 1e-3
+  cornerbubspac = 1
+
+  faceradius_variation = 0
+  faceradius_variation_type = normal
+  cornerradius_variation = 0
+  cornerradius_variation_type = normal
+
+  invalue = 1
+  outvalue = 0
+  numtries = 1e6
+[]
+
+[Variables]
+  [./PolycrystalVariables]
+  [../]
+  [./etab]
+  [../]
+[]
+  
+[AuxVariables]
+  [./bnds]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+  [./unique_grains]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./elastic_strain_11]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./elastic_strain_12]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./stress_11]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./stress_12]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./C1111]
+    order = CONSTANT
+    family = MONOMIAL
+    [../]
+  [./C1122]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./C1212]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[ICs]
+  [./PolycrystalICs]
+    [./PolycrystalVoronoiCoupledVoidIC]
+      v = etab
+      polycrystal_ic_uo = voronoi_ic_uo
+    [../]
+  [../]
+  [./pore_IC]
+    type = PolycrystalVoronoiIntergranularVoidIC
+    variable = etab
+    polycrystal_ic_uo = voronoi_ic_uo
+  [../]
+[]
+  
+[UserObjects]
+  [./voronoi_ic_uo]
+    type = PolycrystalVoronoi
+    coloring_algorithm = jp
+    file_name = 'input_mps_3micron-grains_coordinates_3D.txt'
+  [../]
+  [./euler_angle_file]
+      type = EulerAngleFileReader
+      file_name =  input_10grains_texture_3D.tex
+  [../]
+  [./grain_tracker]
+      type = GrainTrackerElasticity
+      threshold = 0.2
+      compute_var_to_feature_map = true
+      execute_on = 'initial'
+      flood_entity_type = ELEMENTAL
+      fill_method = symmetric9
+      C_ijkl = '144.3 80.36 80.36 144.3 80.36 144.3 32.07 32.07 32.07' # 2 vol. pct. intra gas bubble
+      euler_angle_provider = euler_angle_file
+      outputs = csv
+  [../]
+[]
+
+[BCs]
+  [./Periodic]
+    [./All]
+      auto_direction = 'x y z'
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./ACb0_bulk]
+    type = ACGrGrMulti
+    variable = etab
+    mob_name = L
+    v = 'etam0 etam1 etam2 etam3 etam4 etam5 etam6 etam7 etam8 etam9 '
+    gamma_names = ' gmb  gmb  gmb  gmb  gmb  gmb  gmb  gmb  gmb  gmb  '
+  [../]
+  [./ACm0_bulk]
+    type = ACGrGrMulti
+    variable = etam0
+    mob_name = L
+    v = 'etab etam1 etam2 etam3 etam4 etam5 etam6 etam7 etam8 etam9 '
+    gamma_names = 'gmb  gmm  gmm  gmm  gmm  gmm  gmm  gmm  gmm  gmm  '
+  [../]
+  [./ACm1_bulk]
+    type = ACGrGrMulti
+    variable = etam1
+    mob_name = L
+    v = 'etab etam0 etam2 etam3 etam4 etam5 etam6 etam7 etam8 etam9 '
+    gamma_names = 'gmb  gmm  gmm  gmm  gmm  gmm  gmm  gmm  gmm  gmm  '
+  [../]
+  [./ACm2_bulk]
+    type = ACGrGrMulti
+    variable = etam2
+    mob_name = L
+    v = 'etab etam0 etam1 etam3 etam4 etam5 etam6 etam7 etam8 etam9 '
+    gamma_names = 'gmb  gmm  gmm  gmm  gmm  gmm  gmm  gmm  gmm  gmm  '
+  [../]
+  [./ACm3_bulk]
+    type = ACGrGrMulti
+    variable = etam3
+    mob_name = L
+    v = 'etab etam0 etam1 etam2 etam4 etam5 etam6 etam7 etam8 etam9 '
+    gamma_names = 'gmb  gmm  gmm  gmm  gmm  gmm  gmm  gmm  gmm  gmm  '
+  [../]
+  [./ACm4_bulk]
+    type = ACGrGrMulti
+    variable = etam4
+    mob_name = L
+    v = 'etab etam0 etam1 etam2 etam3 etam5 etam6 etam7 etam8 etam9 '
+    gamma_names = 'gmb  gmm  gmm  gmm  gmm  gmm  gmm  gmm  gmm  gmm  '
+  [../]
+  [./ACm5_bulk]
+    type = ACGrGrMulti
+    variable = etam5
+    mob_name = L
+    v = 'etab etam0 etam1 etam2 etam3 etam4 etam6 etam7 etam8 etam9 '
+    gamma_names = 'gmb  gmm  gmm  gmm  gmm  gmm  gmm  gmm  gmm  gmm  '
+  [../]
+  [./ACm6_bulk]
+    type = ACGrGrMulti
+    variable = etam6
+    mob_name = L
+    v = 'etab etam0 etam1 etam2 etam3 etam4 etam5 etam7 etam8 etam9 '
+    gamma_names = 'gmb  gmm  gmm  gmm  gmm  gmm  gmm  gmm  gmm  gmm  '
+  [../]
+  [./ACm7_bulk]
+    type = ACGrGrMulti
+    variable = etam7
+    mob_name = L
+    v = 'etab etam0 etam1 etam2 etam3 etam4 etam5 etam6 etam8 etam9 '
+    gamma_names = 'gmb  gmm  gmm  gmm  gmm  gmm  gmm  gmm  gmm  gmm  '
+  [../]
+  [./ACm8_bulk]
+    type = ACGrGrMulti
+    variable = etam8
+    mob_name = L
+    v = 'etab etam0 etam1 etam2 etam3 etam4 etam5 etam6 etam7 etam9 '
+    gamma_names = 'gmb  gmm  gmm  gmm  gmm  gmm  gmm  gmm  gmm  gmm  '
+  [../]
+  [./ACm9_bulk]
+    type = ACGrGrMulti
+    variable = etam9
+    mob_name = L
+    v = 'etab etam0 etam1 etam2 etam3 etam4 etam5 etam6 etam7 etam8 '
+    gamma_names = 'gmb  gmm  gmm  gmm  gmm  gmm  gmm  gmm  gmm  gmm  '
+  [../]
+  
+  [./ACb_sw]
+    type = ACSwitching
+    variable = etab
+    mob_name = L
+    Fj_names = 'f0b      f0m'
+    hj_names = 'hb       hm'
+    coupled_variables = 'etam0 etam1 etam2 etam3 etam4 etam5 etam6 etam7 etam8 etam9 '
+  [../]
+  [./ACm0_sw]
+    type = ACSwitching
+    variable = etam0
+    mob_name = L
+    Fj_names = 'f0b      f0m'
+    hj_names = 'hb       hm'
+    coupled_variables = 'etab etam1 etam2 etam3 etam4 etam5 etam6 etam7 etam8 etam9 '
+  [../]
+  [./ACm1_sw]
+    type = ACSwitching
+    variable = etam1
+    mob_name = L
+    Fj_names = 'f0b      f0m'
+    hj_names = 'hb       hm'
+    coupled_variables = 'etab etam0 etam2 etam3 etam4 etam5 etam6 etam7 etam8 etam9 '
+  [../]
+  [./ACm2_sw]
+    type = ACSwitching
+    variable = etam2
+    mob_name = L
+    Fj_names = 'f0b      f0m'
+    hj_names = 'hb       hm'
+    coupled_variables = 'etab etam0 etam1 etam3 etam4 etam5 etam6 etam7 etam8 etam9 '
+  [../]
+  [./ACm3_sw]
+    type = ACSwitching
+    variable = etam3
+    mob_name = L
+    Fj_names = 'f0b      f0m'
+    hj_names = 'hb       hm'
+    coupled_variables = 'etab etam0 etam1 etam2 etam4 etam5 etam6 etam7 etam8 etam9 '
+  [../]
+  [./ACm4_sw]
+    type = ACSwitching
+    variable = etam4
+    mob_name = L
+    Fj_names = 'f0b      f0m'
+    hj_names = 'hb       hm'
+    coupled_variables = 'etab etam0 etam1 etam2 etam3 etam5 etam6 etam7 etam8 etam9 '
+  [../]
+  [./ACm5_sw]
+    type = ACSwitching
+    variable = etam5
+    mob_name = L
+    Fj_names = 'f0b      f0m'
+    hj_names = 'hb       hm'
+    coupled_variables = 'etab etam0 etam1 etam2 etam3 etam4 etam6 etam7 etam8 etam9 '
+  [../]
+  [./ACm6_sw]
+    type = ACSwitching
+    variable = etam6
+    mob_name = L
+    Fj_names = 'f0b      f0m'
+    hj_names = 'hb       hm'
+    coupled_variables = 'etab etam0 etam1 etam2 etam3 etam4 etam5 etam7 etam8 etam9 '
+  [../]
+  [./ACm7_sw]
+    type = ACSwitching
+    variable = etam7
+    mob_name = L
+    Fj_names = 'f0b      f0m'
+    hj_names = 'hb       hm'
+    coupled_variables = 'etab etam0 etam1 etam2 etam3 etam4 etam5 etam6 etam8 etam9 '
+  [../]
+  [./ACm8_sw]
+    type = ACSwitching
+    variable = etam8
+    mob_name = L
+    Fj_names = 'f0b      f0m'
+    hj_names = 'hb       hm'
+    coupled_variables = 'etab etam0 etam1 etam2 etam3 etam4 etam5 etam6 etam7 etam9 '
+  [../]
+  [./ACm9_sw]
+    type = ACSwitching
+    variable = etam9
+    mob_name = L
+    Fj_names = 'f0b      f0m'
+    hj_names = 'hb       hm'
+    coupled_variables = 'etab etam0 etam1 etam2 etam3 etam4 etam5 etam6 etam7 etam8 '
+  [../]
+    
+  [./ACb_int]
+    type = ACInterface
+    variable = etab
+    mob_name = L
+    kappa_name = kappa
+  [../]
+  [./ACm0_int]
+    type = ACInterface
+    variable = etam0
+    mob_name = L
+    kappa_name = kappa
+  [../]
+  [./ACm1_int]
+    type = ACInterface
+    variable = etam1
+    mob_name = L
+    kappa_name = kappa
+  [../]
+  [./ACm2_int]
+    type = ACInterface
+    variable = etam2
+    mob_name = L
+    kappa_name = kappa
+  [../]
+  [./ACm3_int]
+    type = ACInterface
+    variable = etam3
+    mob_name = L
+    kappa_name = kappa
+  [../]
+  [./ACm4_int]
+    type = ACInterface
+    variable = etam4
+    mob_name = L
+    kappa_name = kappa
+  [../]
+  [./ACm5_int]
+    type = ACInterface
+    variable = etam5
+    mob_name = L
+    kappa_name = kappa
+  [../]
+  [./ACm6_int]
+    type = ACInterface
+    variable = etam6
+    mob_name = L
+    kappa_name = kappa
+  [../]
+  [./ACm7_int]
+    type = ACInterface
+    variable = etam7
+    mob_name = L
+    kappa_name = kappa
+  [../]
+  [./ACm8_int]
+    type = ACInterface
+    variable = etam8
+    mob_name = L
+    kappa_name = kappa
+  [../]
+  [./ACm9_int]
+    type = ACInterface
+    variable = etam9
+    mob_name = L
+    kappa_name = kappa
+  [../]
+  
+  [./etab_dot]
+    type = TimeDerivative
+    variable = etab
+  [../]
+  [./etam0_dot]
+    type = TimeDerivative
+    variable = etam0
+  [../]
+  [./etam1_dot]
+    type = TimeDerivative
+    variable = etam1
+  [../]
+  [./etam2_dot]
+    type = TimeDerivative
+    variable = etam2
+  [../]
+  [./etam3_dot]
+    type = TimeDerivative
+    variable = etam3
+  [../]
+  [./etam4_dot]
+    type = TimeDerivative
+    variable = etam4
+  [../]
+  [./etam5_dot]
+    type = TimeDerivative
+    variable = etam5
+  [../]
+  [./etam6_dot]
+    type = TimeDerivative
+    variable = etam6
+  [../]
+  [./etam7_dot]
+    type = TimeDerivative
+    variable = etam7
+  [../]
+  [./etam8_dot]
+    type = TimeDerivative
+    variable = etam8
+  [../]
+  [./etam9_dot]
+    type = TimeDerivative
+    variable = etam9
+  [../]
+[]
+
+[Materials]
+  [./constants_new_U10Mo]
+    type = GenericConstantMaterial
+    prop_names =  'kappa        L        f0b     f0m    mu        gmb 	     gmm  '    # length scale = 30 nm, energy scale = 64e9 J/m3
+    prop_values = '1.0547       100       0      0      0.0023    0.5522     1.5   '
+  [../]
+
+  [./hb]
+    type = SwitchingFunctionMultiPhaseMaterial
+    h_name = hb
+    all_etas = 'etab etam0 etam1 etam2 etam3 etam4 etam5 etam6 etam7 etam8 etam9'
+    phase_etas = 'etab'
+  [../]
+  [./hm]
+    type = SwitchingFunctionMultiPhaseMaterial
+    h_name = hm
+    all_etas = 'etab etam0 etam1 etam2 etam3 etam4 etam5 etam6 etam7 etam8 etam9'
+    phase_etas = 'etam0 etam1 etam2 etam3 etam4 etam5 etam6 etam7 etam8 etam9'
+  [../]
+
+  [./matrixElasticityTensor]
+    type = ComputePolycrystalElasticityTensor 
+    block = 0
+    base_name = Cijkl_matrix 
+    grain_tracker = grain_tracker
+  [../]
+
+  [./elasticity_tensor_pore]
+    type = ComputeElasticityTensor
+    block = 0
+    base_name = Cijkl_pore
+    C_ijkl = '1e-3 1e-3 1e-3 1e-3 1e-3 1e-3 1e-3 1e-3 1e-3'
+    fill_method = symmetric9
+  [../]
+  [./elasticity_tensor_matrix_pore_composite]
+    type = CompositeElasticityTensor
+    block = 0
+    tensors = 'Cijkl_matrix Cijkl_pore'
+    weights = 'hm            hb'
+    coupled_variables = 'etab etam0 etam1 etam2 etam3 etam4 etam5 etam6 etam7 etam8 etam9'
+  [../]
+[]
+
+[AuxKernels]
+  [./BndsCalc]
+    type = BndsCalcAux
+    variable = bnds
+    execute_on = 'timestep_end'
+  [../]
+  [./unique_grains]
+    type = FeatureFloodCountAux
+    variable = unique_grains
+    flood_counter = grain_tracker
+    field_display = UNIQUE_REGION
+    execute_on = 'initial timestep_end'
+  [../]
+  [./elastic_strain_11]
+    type = RankTwoAux
+    variable = elastic_strain_11
+    rank_two_tensor = elastic_strain
+    index_i = 0
+    index_j = 0
+    execute_on = timestep_end
+  [../]
+  [./elastic_strain_12]
+    type = RankTwoAux
+    variable = elastic_strain_12
+    rank_two_tensor = elastic_strain
+    index_i = 0
+    index_j = 1
+    execute_on = timestep_end
+  [../]  
+  [./stress_11]
+    type = RankTwoAux
+    variable = stress_11
+    rank_two_tensor = stress
+    index_i = 0
+    index_j = 0
+    execute_on = timestep_end
+  [../]
+  [./stress_12]
+    type = RankTwoAux
+    variable = stress_12
+    rank_two_tensor = stress
+    index_i = 0
+    index_j = 1
+    execute_on = timestep_end
+  [../]
+  [./C1111]
+    type = RankFourAux
+    variable = C1111
+    rank_four_tensor = elasticity_tensor
+    index_i = 0
+    index_j = 0
+    index_k = 0
+    index_l = 0
+    execute_on = timestep_end
+  [../]
+  [./C1122]
+    type = RankFourAux
+    variable = C1122
+    rank_four_tensor = elasticity_tensor
+    index_i = 0
+    index_j = 0
+    index_k = 1
+    index_l = 1
+    execute_on = timestep_end
+  [../]
+  [./C1212]
+    type = RankFourAux
+    variable = C1212
+    rank_four_tensor = elasticity_tensor
+    index_i = 0
+    index_j = 1
+    index_k = 0
+    index_l = 1
+    execute_on = timestep_end
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./feature_volumes_etab]
+    type = FeatureVolumeVectorPostprocessor
+    flood_counter = feature_counter_etab
+    execute_on = 'timestep_end'
+    single_feature_per_element = true
+  [../]
+[]
+
+[Postprocessors]
+  [./feature_counter_etab]
+    type = FeatureFloodCount
+    variable = etab
+    threshold = 0.5
+    compute_var_to_feature_map = true
+    execute_on = 'timestep_end'
+  [../]
+  [./Volume]
+    type = VolumePostprocessor
+    execute_on = 'timestep_end'
+  [../]
+  [./volume_fraction]
+    type = FeatureVolumeFraction
+    mesh_volume = Volume
+    feature_volumes = feature_volumes_etab
+    execute_on = 'timestep_end'
+  [../]
+  [./dt]
+    type = TimestepSize
+  [../]
+  [./dofs]
+    type = NumDOFs
+  [../]
+  [./run_time]
+    type = PerfGraphData
+    section_name = "Root"
+    data_type = total
+  [../]
+  [numbub]
+    type = FeatureFloodCount
+    variable = etab
+  []
+[]
+
+[AEHElasticConstants]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+  [../]
+[]
+
+[Executioner]
+  type = AEHTransient
+  scheme = bdf2
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type -ksp_gmres_restart -pc_hypre_boomeramg_strong_threshold'
+  petsc_options_value = 'hypre boomeramg 31 0.7'
+  l_tol = 1.0e-4
+  l_max_its = 30
+  nl_max_its = 40
+  nl_rel_tol = 1.0e-7
+  start_time = 0.0
+
+  end_time = 10
+
+  [./TimeStepper]
+    type = IterationAdaptiveDT
+    dt = 1
+    growth_factor = 1.2
+    cutback_factor = 0.8
+    optimal_iterations = 8
+  [../]
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  exodus = true
+  csv = true
+  checkpoint = true
+[]
@@ -0,0 +1,730 @@
+# Computes the homogenized elastic constants of a heterogeneous, anisotropic cell with the 18
+# fluctuation displacements of the fully coupled path, solved by the transient, and with the
+# AEHElasticConstants block, solved once by AEHTransient. The Terminator fails the run if any of
+# the 21 constants differ. The load cases are solved with the default AEH solver options, the
+# tests spec also runs them with a direct solver.
+[Problem]
+  nl_sys_names = 'nl0 aeh'
+  kernel_coverage_check = false
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 4
+  ny = 4
+  nz = 4
+  elem_type = HEX8
+[]
+
+[GlobalParams]
+  dx_xx = dx_xx
+  dx_yy = dx_yy
+  dx_zz = dx_zz
+  dx_xy = dx_xy
+  dx_yz = dx_yz
+  dx_zx = dx_xz
+  dy_xx = dy_xx
+  dy_yy = dy_yy
+  dy_zz = dy_zz
+  dy_xy = dy_xy
+  dy_yz = dy_yz
+  dy_zx = dy_xz
+  dz_xx = dz_xx
+  dz_yy = dz_yy
+  dz_zz = dz_zz
+  dz_xy = dz_xy
+  dz_yz = dz_yz
+  dz_zx = dz_xz
+
+  # Generic anisotropic constants, scaled by a stiffness varying across the cell
+  C_ijkl = '200 80 70 5 3 2 190 75 4 6 1 180 2 3 5 60 4 3 55 2 50'
+  fill_method = symmetric21
+  elasticity_tensor_prefactor = stiffness
+[]
+
+[Functions]
+  [./stiffness]
+    type = ParsedFunction
+    expression = '1 + 0.5 * sin(2 * pi * x) * cos(2 * pi * y) + 0.3 * sin(2 * pi * z)'
+  [../]
+[]
+
+[Variables]
+  [./dx_xx]
+  [../]
+  [./dy_xx]
+  [../]
+  [./dz_xx]
+  [../]
+  [./dx_yy]
+  [../]
+  [./dy_yy]
+  [../]
+  [./dz_yy]
+  [../]
+  [./dx_zz]
+  [../]
+  [./dy_zz]
+  [../]
+  [./dz_zz]
+  [../]
+  [./dx_xy]
+  [../]
+  [./dy_xy]
+  [../]
+  [./dz_xy]
+  [../]
+  [./dx_xz]
+  [../]
+  [./dy_xz]
+  [../]
+  [./dz_xz]
+  [../]
+  [./dx_yz]
+  [../]
+  [./dy_yz]
+  [../]
+  [./dz_yz]
+  [../]
+[]
+
+[Kernels]
+  [./aeh_dx_xx]
+    type = AsymptoticExpansionHomogenizationKernel
+    variable = dx_xx
+    component = 0
+    column = xx
+    base_name = xx
+  [../]
+  [./div_x_xx]
+    type = StressDivergenceTensors
+    variable = dx_xx
+    component = 0
+    displacements = 'dx_xx dy_xx dz_xx'
+    use_displaced_mesh = false
+    base_name = xx
+  [../]
+  [./aeh_dy_xx]
+    type = AsymptoticExpansionHomogenizationKernel
+    variable = dy_xx
+    component = 1
+    column = xx
+    base_name = xx
+  [../]
+  [./div_y_xx]
+    type = StressDivergenceTensors
+    variable = dy_xx
+    component = 1
+    displacements = 'dx_xx dy_xx dz_xx'
+    use_displaced_mesh = false
+    base_name = xx
+  [../]
+  [./aeh_dz_xx]
+    type = AsymptoticExpansionHomogenizationKernel
+    variable = dz_xx
+    component = 2
+    column = xx
+    base_name = xx
+  [../]
+  [./div_z_xx]
+    type = StressDivergenceTensors
+    variable = dz_xx
+    component = 2
+    displacements = 'dx_xx dy_xx dz_xx'
+    use_displaced_mesh = false
+    base_name = xx
+  [../]
+  [./aeh_dx_yy]
+    type = AsymptoticExpansionHomogenizationKernel
+    variable = dx_yy
+    component = 0
+    column = yy
+    base_name = yy
+  [../]
+  [./div_x_yy]
+    type = StressDivergenceTensors
+    variable = dx_yy
+    component = 0
+    displacements = 'dx_yy dy_yy dz_yy'
+    use_displaced_mesh = false
+    base_name = yy
+  [../]
+  [./aeh_dy_yy]
+    type = AsymptoticExpansionHomogenizationKernel
+    variable = dy_yy
+    component = 1
+    column = yy
+    base_name = yy
+  [../]
+  [./div_y_yy]
+    type = StressDivergenceTensors
+    variable = dy_yy
+    component = 1
+    displacements = 'dx_yy dy_yy dz_yy'
+    use_displaced_mesh = false
+    base_name = yy
+  [../]
+  [./aeh_dz_yy]
+    type = AsymptoticExpansionHomogenizationKernel
+    variable = dz_yy
+    component = 2
+    column = yy
+    base_name = yy
+  [../]
+  [./div_z_yy]
+    type = StressDivergenceTensors
+    variable = dz_yy
+    component = 2
+    displacements = 'dx_yy dy_yy dz_yy'
+    use_displaced_mesh = false
+    base_name = yy
+  [../]
+  [./aeh_dx_zz]
+    type = AsymptoticExpansionHomogenizationKernel
+    variable = dx_zz
+    component = 0
+    column = zz
+    base_name = zz
+  [../]
+  [./div_x_zz]
+    type = StressDivergenceTensors
+    variable = dx_zz
+    component = 0
+    displacements = 'dx_zz dy_zz dz_zz'
+    use_displaced_mesh = false
+    base_name = zz
+  [../]
+  [./aeh_dy_zz]
+    type = AsymptoticExpansionHomogenizationKernel
+    variable = dy_zz
+    component = 1
+    column = zz
+    base_name = zz
+  [../]
+  [./div_y_zz]
+    type = StressDivergenceTensors
+    variable = dy_zz
+    component = 1
+    displacements = 'dx_zz dy_zz dz_zz'
+    use_displaced_mesh = false
+    base_name = zz
+  [../]
+  [./aeh_dz_zz]
+    type = AsymptoticExpansionHomogenizationKernel
+    variable = dz_zz
+    component = 2
+    column = zz
+    base_name = zz
+  [../]
+  [./div_z_zz]
+    type = StressDivergenceTensors
+    variable = dz_zz
+    component = 2
+    displacements = 'dx_zz dy_zz dz_zz'
+    use_displaced_mesh = false
+    base_name = zz
+  [../]
+  [./aeh_dx_xy]
+    type = AsymptoticExpansionHomogenizationKernel
+    variable = dx_xy
+    component = 0
+    column = xy
+    base_name = xy
+  [../]
+  [./div_x_xy]
+    type = StressDivergenceTensors
+    variable = dx_xy
+    component = 0
+    displacements = 'dx_xy dy_xy dz_xy'
+    use_displaced_mesh = false
+    base_name = xy
+  [../]
+  [./aeh_dy_xy]
+    type = AsymptoticExpansionHomogenizationKernel
+    variable = dy_xy
+    component = 1
+    column = xy
+    base_name = xy
+  [../]
+  [./div_y_xy]
+    type = StressDivergenceTensors
+    variable = dy_xy
+    component = 1
+    displacements = 'dx_xy dy_xy dz_xy'
+    use_displaced_mesh = false
+    base_name = xy
+  [../]
+  [./aeh_dz_xy]
+    type = AsymptoticExpansionHomogenizationKernel
+    variable = dz_xy
+    component = 2
+    column = xy
+    base_name = xy
+  [../]
+  [./div_z_xy]
+    type = StressDivergenceTensors
+    variable = dz_xy
+    component = 2
+    displacements = 'dx_xy dy_xy dz_xy'
+    use_displaced_mesh = false
+    base_name = xy
+  [../]
+  [./aeh_dx_xz]
+    type = AsymptoticExpansionHomogenizationKernel
+    variable = dx_xz
+    component = 0
+    column = xz
+    base_name = xz
+  [../]
+  [./div_x_xz]
+    type = StressDivergenceTensors
+    variable = dx_xz
+    component = 0
+    displacements = 'dx_xz dy_xz dz_xz'
+    use_displaced_mesh = false
+    base_name = xz
+  [../]
+  [./aeh_dy_xz]
+    type = AsymptoticExpansionHomogenizationKernel
+    variable = dy_xz
+    component = 1
+    column = xz
+    base_name = xz
+  [../]
+  [./div_y_xz]
+    type = StressDivergenceTensors
+    variable = dy_xz
+    component = 1
+    displacements = 'dx_xz dy_xz dz_xz'
+    use_displaced_mesh = false
+    base_name = xz
+  [../]
+  [./aeh_dz_xz]
+    type = AsymptoticExpansionHomogenizationKernel
+    variable = dz_xz
+    component = 2
+    column = xz
+    base_name = xz
+  [../]
+  [./div_z_xz]
+    type = StressDivergenceTensors
+    variable = dz_xz
+    component = 2
+    displacements = 'dx_xz dy_xz dz_xz'
+    use_displaced_mesh = false
+    base_name = xz
+  [../]
+  [./aeh_dx_yz]
+    type = AsymptoticExpansionHomogenizationKernel
+    variable = dx_yz
+    component = 0
+    column = yz
+    base_name = yz
+  [../]
+  [./div_x_yz]
+    type = StressDivergenceTensors
+    variable = dx_yz
+    component = 0
+    displacements = 'dx_yz dy_yz dz_yz'
+    use_displaced_mesh = false
+    base_name = yz
+  [../]
+  [./aeh_dy_yz]
+    type = AsymptoticExpansionHomogenizationKernel
+    variable = dy_yz
+    component = 1
+    column = yz
+    base_name = yz
+  [../]
+  [./div_y_yz]
+    type = StressDivergenceTensors
+    variable = dy_yz
+    component = 1
+    displacements = 'dx_yz dy_yz dz_yz'
+    use_displaced_mesh = false
+    base_name = yz
+  [../]
+  [./aeh_dz_yz]
+    type = AsymptoticExpansionHomogenizationKernel
+    variable = dz_yz
+    component = 2
+    column = yz
+    base_name = yz
+  [../]
+  [./div_z_yz]
+    type = StressDivergenceTensors
+    variable = dz_yz
+    component = 2
+    displacements = 'dx_yz dy_yz dz_yz'
+    use_displaced_mesh = false
+    base_name = yz
+  [../]
+[]
+
+[BCs]
+  [./dx_xx_pin]
+    type = DirichletBC
+    variable = dx_xx
+    boundary = 'left right'
+    value = 0
+  [../]
+  [./dy_xx_pin]
+    type = DirichletBC
+    variable = dy_xx
+    boundary = 'bottom top'
+    value = 0
+  [../]
+  [./dz_xx_pin]
+    type = DirichletBC
+    variable = dz_xx
+    boundary = 'back front'
+    value = 0
+  [../]
+  [./dx_yy_pin]
+    type = DirichletBC
+    variable = dx_yy
+    boundary = 'left right'
+    value = 0
+  [../]
+  [./dy_yy_pin]
+    type = DirichletBC
+    variable = dy_yy
+    boundary = 'bottom top'
+    value = 0
+  [../]
+  [./dz_yy_pin]
+    type = DirichletBC
+    variable = dz_yy
+    boundary = 'back front'
+    value = 0
+  [../]
+  [./dx_zz_pin]
+    type = DirichletBC
+    variable = dx_zz
+    boundary = 'left right'
+    value = 0
+  [../]
+  [./dy_zz_pin]
+    type = DirichletBC
+    variable = dy_zz
+    boundary = 'bottom top'
+    value = 0
+  [../]
+  [./dz_zz_pin]
+    type = DirichletBC
+    variable = dz_zz
+    boundary = 'back front'
+    value = 0
+  [../]
+  [./dx_xy_pin]
+    type = DirichletBC
+    variable = dx_xy
+    boundary = 'left right'
+    value = 0
+  [../]
+  [./dy_xy_pin]
+    type = DirichletBC
+    variable = dy_xy
+    boundary = 'bottom top'
+    value = 0
+  [../]
+  [./dz_xy_pin]
+    type = DirichletBC
+    variable = dz_xy
+    boundary = 'back front'
+    value = 0
+  [../]
+  [./dx_xz_pin]
+    type = DirichletBC
+    variable = dx_xz
+    boundary = 'left right'
+    value = 0
+  [../]
+  [./dy_xz_pin]
+    type = DirichletBC
+    variable = dy_xz
+    boundary = 'bottom top'
+    value = 0
+  [../]
+  [./dz_xz_pin]
+    type = DirichletBC
+    variable = dz_xz
+    boundary = 'back front'
+    value = 0
+  [../]
+  [./dx_yz_pin]
+    type = DirichletBC
+    variable = dx_yz
+    boundary = 'left right'
+    value = 0
+  [../]
+  [./dy_yz_pin]
+    type = DirichletBC
+    variable = dy_yz
+    boundary = 'bottom top'
+    value = 0
+  [../]
+  [./dz_yz_pin]
+    type = DirichletBC
+    variable = dz_yz
+    boundary = 'back front'
+    value = 0
+  [../]
+[]
+
+[AEHElasticConstants]
+[]
+
+[Materials]
+  [./elasticity_tensor]
+    type = ComputeElasticityTensor
+  [../]
+  [./elasticity_tensor_xx]
+    type = ComputeElasticityTensor
+    base_name = xx
+  [../]
+  [./strain_xx]
+    type = ComputeSmallStrain
+    displacements = 'dx_xx dy_xx dz_xx'
+    base_name = xx
+  [../]
+  [./stress_xx]
+    type = ComputeLinearElasticStress
+    base_name = xx
+  [../]
+  [./elasticity_tensor_yy]
+    type = ComputeElasticityTensor
+    base_name = yy
+  [../]
+  [./strain_yy]
+    type = ComputeSmallStrain
+    displacements = 'dx_yy dy_yy dz_yy'
+    base_name = yy
+  [../]
+  [./stress_yy]
+    type = ComputeLinearElasticStress
+    base_name = yy
+  [../]
+  [./elasticity_tensor_zz]
+    type = ComputeElasticityTensor
+    base_name = zz
+  [../]
+  [./strain_zz]
+    type = ComputeSmallStrain
+    displacements = 'dx_zz dy_zz dz_zz'
+    base_name = zz
+  [../]
+  [./stress_zz]
+    type = ComputeLinearElasticStress
+    base_name = zz
+  [../]
+  [./elasticity_tensor_xy]
+    type = ComputeElasticityTensor
+    base_name = xy
+  [../]
+  [./strain_xy]
+    type = ComputeSmallStrain
+    displacements = 'dx_xy dy_xy dz_xy'
+    base_name = xy
+  [../]
+  [./stress_xy]
+    type = ComputeLinearElasticStress
+    base_name = xy
+  [../]
+  [./elasticity_tensor_xz]
+    type = ComputeElasticityTensor
+    base_name = xz
+  [../]
+  [./strain_xz]
+    type = ComputeSmallStrain
+    displacements = 'dx_xz dy_xz dz_xz'
+    base_name = xz
+  [../]
+  [./stress_xz]
+    type = ComputeLinearElasticStress
+    base_name = xz
+  [../]
+  [./elasticity_tensor_yz]
+    type = ComputeElasticityTensor
+    base_name = yz
+  [../]
+  [./strain_yz]
+    type = ComputeSmallStrain
+    displacements = 'dx_yz dy_yz dz_yz'
+    base_name = yz
+  [../]
+  [./stress_yz]
+    type = ComputeLinearElasticStress
+    base_name = yz
+  [../]
+[]
+
+[Postprocessors]
+  [./ref_H1111]
+    type = AsymptoticExpansionHomogenizationElasticConstants
+    base_name = xx
+    row = xx
+    column = xx
+  [../]
+  [./ref_H1122]
+    type = AsymptoticExpansionHomogenizationElasticConstants
+    base_name = xx
+    row = xx
+    column = yy
+  [../]
+  [./ref_H1133]
+    type = AsymptoticExpansionHomogenizationElasticConstants
+    base_name = xx
+    row = xx
+    column = zz
+  [../]
+  [./ref_H1123]
+    type = AsymptoticExpansionHomogenizationElasticConstants
+    base_name = xx
+    row = xx
+    column = yz
+  [../]
+  [./ref_H1113]
+    type = AsymptoticExpansionHomogenizationElasticConstants
+    base_name = xx
+    row = xx
+    column = xz
+  [../]
+  [./ref_H1112]
+    type = AsymptoticExpansionHomogenizationElasticConstants
+    base_name = xx
+    row = xx
+    column = xy
+  [../]
+  [./ref_H2222]
+    type = AsymptoticExpansionHomogenizationElasticConstants
+    base_name = xx
+    row = yy
+    column = yy
+  [../]
+  [./ref_H2233]
+    type = AsymptoticExpansionHomogenizationElasticConstants
+    base_name = xx
+    row = yy
+    column = zz
+  [../]
+  [./ref_H2223]
+    type = AsymptoticExpansionHomogenizationElasticConstants
+    base_name = xx
+    row = yy
+    column = yz
+  [../]
+  [./ref_H2213]
+    type = AsymptoticExpansionHomogenizationElasticConstants
+    base_name = xx
+    row = yy
+    column = xz
+  [../]
+  [./ref_H2212]
+    type = AsymptoticExpansionHomogenizationElasticConstants
+    base_name = xx
+    row = yy
+    column = xy
+  [../]
+  [./ref_H3333]
+    type = AsymptoticExpansionHomogenizationElasticConstants
+    base_name = xx
+    row = zz
+    column = zz
+  [../]
+  [./ref_H3323]
+    type = AsymptoticExpansionHomogenizationElasticConstants
+    base_name = xx
+    row = zz
+    column = yz
+  [../]
+  [./ref_H3313]
+    type = AsymptoticExpansionHomogenizationElasticConstants
+    base_name = xx
+    row = zz
+    column = xz
+  [../]
+  [./ref_H3312]
+    type = AsymptoticExpansionHomogenizationElasticConstants
+    base_name = xx
+    row = zz
+    column = xy
+  [../]
+  [./ref_H2323]
+    type = AsymptoticExpansionHomogenizationElasticConstants
+    base_name = xx
+    row = yz
+    column = yz
+  [../]
+  [./ref_H2313]
+    type = AsymptoticExpansionHomogenizationElasticConstants
+    base_name = xx
+    row = yz
+    column = xz
+  [../]
+  [./ref_H2312]
+    type = AsymptoticExpansionHomogenizationElasticConstants
+    base_name = xx
+    row = yz
+    column = xy
+  [../]
+  [./ref_H1313]
+    type = AsymptoticExpansionHomogenizationElasticConstants
+    base_name = xx
+    row = xz
+    column = xz
+  [../]
+  [./ref_H1312]
+    type = AsymptoticExpansionHomogenizationElasticConstants
+    base_name = xx
+    row = xz
+    column = xy
+  [../]
+  [./ref_H1212]
+    type = AsymptoticExpansionHomogenizationElasticConstants
+    base_name = xx
+    row = xy
+    column = xy
+  [../]
+[]
+
+[UserObjects]
+  [./check]
+    type = Terminator
+    expression = 'abs(H1111 - ref_H1111) + abs(H1122 - ref_H1122) + abs(H1133 - ref_H1133) +
+                  abs(H1123 - ref_H1123) + abs(H1113 - ref_H1113) + abs(H1112 - ref_H1112) +
+                  abs(H2222 - ref_H2222) + abs(H2233 - ref_H2233) + abs(H2223 - ref_H2223) +
+                  abs(H2213 - ref_H2213) + abs(H2212 - ref_H2212) + abs(H3333 - ref_H3333) +
+                  abs(H3323 - ref_H3323) + abs(H3313 - ref_H3313) + abs(H3312 - ref_H3312) +
+                  abs(H2323 - ref_H2323) + abs(H2313 - ref_H2313) + abs(H2312 - ref_H2312) +
+                  abs(H1313 - ref_H1313) + abs(H1312 - ref_H1312) +
+                  abs(H1212 - ref_H1212) > 1e-6 * ref_H1111'
+    fail_mode = HARD
+    error_level = ERROR
+    execute_on = final
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+  [../]
+[]
+
+# The AEH system is solved as a linear problem with its own options, whatever the transient uses
+[Executioner]
+  type = AEHTransient
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  l_tol = 1e-12
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-12
+  num_steps = 1
+[]
+
+[Outputs]
+  csv = true
+[]
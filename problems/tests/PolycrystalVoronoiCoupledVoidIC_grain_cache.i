@@ -0,0 +1,208 @@
+# The grain order parameters are set up twice, once by the action sharing the grain lookups
+# through a PolycrystalVoronoiGrainCache (gr) and once without it (hr). The run fails if they
+# differ anywhere. The grain boundaries are sharp here, the tests spec also runs it with diffuse
+# grain boundaries. The initial conditions are listed before the user objects, which the action
+# has to cope with.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+  xmax = 10
+  ymax = 10
+  uniform_refine = 1
+[]
+
+[GlobalParams]
+  op_num = 8
+  var_name_base = gr
+  grain_num = 8
+
+  int_width = 0.125
+
+  numfacebub = 20
+  facebubspac = 1
+  faceradius = 0.25
+
+  numcornerbub = 5
+  cornerbubspac = 2
+  cornerradius = 0.5
+
+  invalue = 1
+  outvalue = 0
+  numtries = 1e6
+[]
+
+[Variables]
+  [./PolycrystalVariables]
+  [../]
+[]
+
+[AuxVariables]
+  [./void]
+  [../]
+  [./hr0]
+  [../]
+  [./hr1]
+  [../]
+  [./hr2]
+  [../]
+  [./hr3]
+  [../]
+  [./hr4]
+  [../]
+  [./hr5]
+  [../]
+  [./hr6]
+  [../]
+  [./hr7]
+  [../]
+[]
+
+[ICs]
+  [./PolycrystalICs]
+    [./PolycrystalVoronoiCoupledVoidIC]
+      v = void
+      polycrystal_ic_uo = voronoi_ic_uo
+      share_grain_lookup = true
+    [../]
+  [../]
+  [./void]
+    type = PolycrystalVoronoiIntergranularVoidIC
+    variable = void
+    polycrystal_ic_uo = voronoi_ic_uo
+  [../]
+  [./hr0]
+    type = PolycrystalVoronoiCoupledVoidIC
+    variable = hr0
+    op_index = 0
+    v = void
+    polycrystal_ic_uo = voronoi_ic_uo
+  [../]
+  [./hr1]
+    type = PolycrystalVoronoiCoupledVoidIC
+    variable = hr1
+    op_index = 1
+    v = void
+    polycrystal_ic_uo = voronoi_ic_uo
+  [../]
+  [./hr2]
+    type = PolycrystalVoronoiCoupledVoidIC
+    variable = hr2
+    op_index = 2
+    v = void
+    polycrystal_ic_uo = voronoi_ic_uo
+  [../]
+  [./hr3]
+    type = PolycrystalVoronoiCoupledVoidIC
+    variable = hr3
+    op_index = 3
+    v = void
+    polycrystal_ic_uo = voronoi_ic_uo
+  [../]
+  [./hr4]
+    type = PolycrystalVoronoiCoupledVoidIC
+    variable = hr4
+    op_index = 4
+    v = void
+    polycrystal_ic_uo = voronoi_ic_uo
+  [../]
+  [./hr5]
+    type = PolycrystalVoronoiCoupledVoidIC
+    variable = hr5
+    op_index = 5
+    v = void
+    polycrystal_ic_uo = voronoi_ic_uo
+  [../]
+  [./hr6]
+    type = PolycrystalVoronoiCoupledVoidIC
+    variable = hr6
+    op_index = 6
+    v = void
+    polycrystal_ic_uo = voronoi_ic_uo
+  [../]
+  [./hr7]
+    type = PolycrystalVoronoiCoupledVoidIC
+    variable = hr7
+    op_index = 7
+    v = void
+    polycrystal_ic_uo = voronoi_ic_uo
+  [../]
+[]
+
+[UserObjects]
+  [./voronoi_ic_uo]
+    type = PolycrystalVoronoi
+    coloring_algorithm = bt
+    rand_seed = 12345
+    int_width = 0
+  [../]
+  [./terminator]
+    type = Terminator
+    expression = 'diff0 + diff1 + diff2 + diff3 + diff4 + diff5 + diff6 + diff7 > 0'
+    fail_mode = HARD
+    error_level = ERROR
+    message = 'The order parameters differ with and without the grain cache'
+  [../]
+[]
+
+[Postprocessors]
+  [./diff0]
+    type = ElementL2Difference
+    variable = gr0
+    other_variable = hr0
+  [../]
+  [./diff1]
+    type = ElementL2Difference
+    variable = gr1
+    other_variable = hr1
+  [../]
+  [./diff2]
+    type = ElementL2Difference
+    variable = gr2
+    other_variable = hr2
+  [../]
+  [./diff3]
+    type = ElementL2Difference
+    variable = gr3
+    other_variable = hr3
+  [../]
+  [./diff4]
+    type = ElementL2Difference
+    variable = gr4
+    other_variable = hr4
+  [../]
+  [./diff5]
+    type = ElementL2Difference
+    variable = gr5
+    other_variable = hr5
+  [../]
+  [./diff6]
+    type = ElementL2Difference
+    variable = gr6
+    other_variable = hr6
+  [../]
+  [./diff7]
+    type = ElementL2Difference
+    variable = gr7
+    other_variable = hr7
+  [../]
+[]
+
+[BCs]
+  [./Periodic]
+    [./all]
+      auto_direction = 'x y'
+    [../]
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
@@ -0,0 +1,42 @@
+# Places or loads the voids and fails if the void field differs from the one read by
+# UserObjects/reference, which the tests spec points to the output of an earlier run.
+!include PolycrystalVoronoiIntergranularVoidIC_layout.i
+
+[AuxVariables]
+  [./void_reference]
+  [../]
+[]
+
+[UserObjects]
+  [./reference]
+    type = SolutionUserObject
+    system_variables = void
+    timestep = LATEST
+  [../]
+  [./terminator]
+    type = Terminator
+    expression = 'difference > 1e-12'
+    fail_mode = HARD
+    error_level = ERROR
+    message = 'The void field differs from the reference run'
+  [../]
+[]
+
+[AuxKernels]
+  [./void_reference]
+    type = SolutionAux
+    variable = void_reference
+    solution = reference
+    from_variable = void
+    execute_on = initial
+  [../]
+[]
+
+[Postprocessors]
+  [./difference]
+    type = ElementL2Difference
+    variable = void
+    other_variable = void_reference
+  [../]
+[]
+
@@ -0,0 +1,109 @@
+# Refines the elements around the intergranular voids and the grain boundaries once. The
+# Terminator fails the run unless the marker refined some but not all of the 400 elements. The
+# pore fraction is compared against a uniformly refined mesh by
+# PolycrystalVoronoiVoidMarker_uniform_check.i.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  xmax = 10
+  ymax = 10
+[]
+
+[GlobalParams]
+  op_num = 8
+  grain_num = 8
+
+  int_width = 0.125
+
+  numfacebub = 20
+  facebubspac = 1
+  faceradius = 0.25
+
+  numcornerbub = 5
+  cornerbubspac = 2
+  cornerradius = 0.5
+
+  invalue = 1
+  outvalue = 0
+  numtries = 1e6
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./void]
+  [../]
+[]
+
+[UserObjects]
+  [./voronoi_ic_uo]
+    type = PolycrystalVoronoi
+    coloring_algorithm = bt
+    rand_seed = 12345
+  [../]
+  [./check]
+    type = Terminator
+    expression = 'elements <= 400 | elements >= 1600'
+    fail_mode = HARD
+    error_level = ERROR
+  [../]
+[]
+
+[ICs]
+  [./void]
+    type = PolycrystalVoronoiIntergranularVoidIC
+    variable = void
+    polycrystal_ic_uo = voronoi_ic_uo
+  [../]
+[]
+
+[BCs]
+  [./Periodic]
+    [./all]
+      auto_direction = 'x y'
+    [../]
+  [../]
+[]
+
+[Adaptivity]
+  initial_marker = marker
+  initial_steps = 1
+  max_h_level = 1
+  [./Markers]
+    [./marker]
+      type = PolycrystalVoronoiVoidMarker
+      void_ic = void
+    [../]
+  [../]
+[]
+
+[Postprocessors]
+  [./elements]
+    type = NumElems
+    execute_on = 'initial timestep_end'
+  [../]
+  [./pore_fraction]
+    type = ElementAverageValue
+    variable = void
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,33 @@
+# Compares the pore fraction on the adaptively refined mesh against the one of a uniformly
+# refined run, read from its CSV output. The marker refines every element the voids reach into,
+# so both integrate the same nodal values of the void variable.
+!include PolycrystalVoronoiVoidMarker.i
+
+[VectorPostprocessors]
+  [./uniform]
+    type = CSVReaderVectorPostprocessor
+    csv_file = void_marker_uniform.csv
+    execute_on = initial
+  [../]
+[]
+
+[Postprocessors]
+  [./uniform_pore_fraction]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = uniform
+    vector_name = pore_fraction
+    index = 0
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[UserObjects]
+  [./compare]
+    type = Terminator
+    expression = 'uniform_pore_fraction <= 0 | '
+                 'abs(pore_fraction - uniform_pore_fraction) > 1e-6 * uniform_pore_fraction'
+    fail_mode = HARD
+    error_level = ERROR
+    message = 'The pore fraction differs between the adaptively and the uniformly refined mesh'
+  [../]
+[]
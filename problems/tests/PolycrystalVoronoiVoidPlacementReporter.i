@@ -0,0 +1,10 @@
+# Reports the placement of the voids of the layout input. With radii fixed at 0.25 and 0.5, the
+# 20 face and 5 corner voids cover 2.5 pi / 100 = 0.0785398 of the domain.
+!include PolycrystalVoronoiIntergranularVoidIC_layout.i
+
+[Reporters]
+  [./placement]
+    type = PolycrystalVoronoiVoidPlacementReporter
+    void_ic = void
+  [../]
+[]